@@ -0,0 +1,105 @@
+// Farhin Bhuiyan
+#ifndef CLOCK_CACHE_H // Include guard to prevent multiple inclusions of this header file
+#define CLOCK_CACHE_H
+
+#include <vector>         // Include vector for dynamic array
+#include <utility>        // Include utility for std::move
+#include "hash_map.h"     // Include hash map for the key -> slot index
+
+// Bounded cache with CLOCK (second chance) eviction.
+// Entries live in flat slot arrays; a HashMap maps each key to its slot.
+// A hit sets the slot's reference bit. When the cache is full, the clock hand
+// sweeps the slots, clearing set bits, and evicts the first slot whose bit is clear.
+template <typename Key, typename Value>
+class ClockCache {
+ public:
+  // Constructor to create a cache holding at most capacity entries (0 disables caching).
+  // The slot arrays grow as entries arrive, so a large capacity costs nothing up front.
+  explicit ClockCache(size_t capacity) : capacity_(capacity) {}
+
+  // Return the cached value for key, or nullptr on a miss.
+  // The pointer stays valid until the next Put.
+  // A disabled cache (capacity 0) skips the lookup and does not count it.
+  const Value *Get(const Key & key) {
+    if (capacity_ == 0) // Caching is disabled
+      return nullptr;
+    const size_t *slot = index_.Find(key);
+    if (slot == nullptr) {
+      ++misses_;
+      return nullptr;
+    }
+    ++hits_;
+    referenced_[*slot] = true; // Give the entry a second chance
+    return &values_[*slot];
+  }
+
+  // Store value under key, evicting an entry if the cache is full.
+  // key must not already be cached.
+  void Put(const Key & key, Value value) {
+    if (capacity_ == 0) // Caching is disabled
+      return;
+    size_t slot = keys_.size();
+    if (slot < capacity_) { // Still room, use a fresh slot
+      keys_.push_back(key);
+      values_.push_back(std::move(value));
+      referenced_.push_back(false);
+    } else { // Full, find a victim with the clock hand
+      while (referenced_[hand_]) {
+        referenced_[hand_] = false;
+        hand_ = (hand_ + 1) % capacity_;
+      }
+      slot = hand_;
+      hand_ = (hand_ + 1) % capacity_;
+      index_.Remove(keys_[slot]);
+      ++evictions_;
+      keys_[slot] = key;
+      values_[slot] = std::move(value);
+      referenced_[slot] = false;
+    }
+    index_.Emplace(key, slot);
+  }
+
+  // Get the maximum number of entries in the cache
+  size_t Capacity() const {
+    return capacity_;
+  }
+
+  // Get the current number of entries in the cache
+  size_t Size() const {
+    return keys_.size();
+  }
+
+  // Get the number of lookups that found their key
+  size_t Hits() const {
+    return hits_;
+  }
+
+  // Get the number of lookups that did not find their key
+  size_t Misses() const {
+    return misses_;
+  }
+
+  // Get the number of entries evicted to make room
+  size_t Evictions() const {
+    return evictions_;
+  }
+
+  // Get the fraction of lookups that were hits
+  float HitRate() const {
+    size_t lookups = hits_ + misses_;
+    return lookups == 0 ? 0.0f : static_cast<float>(hits_) / lookups;
+  }
+
+ private:
+  size_t capacity_; // Maximum number of entries
+  HashMap<Key, size_t> index_; // Key -> slot in the arrays below
+  std::vector<Key> keys_; // The key held by each slot
+  std::vector<Value> values_; // The value held by each slot
+  std::vector<bool> referenced_; // Reference bit of each slot
+  size_t hand_ = 0; // Next slot the clock hand looks at
+  size_t hits_ = 0; // Number of cache hits
+  size_t misses_ = 0; // Number of cache misses
+  size_t evictions_ = 0; // Number of evicted entries
+};
+
+#endif  // CLOCK_CACHE_H
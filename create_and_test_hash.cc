@@ -4,6 +4,8 @@
 #include <string>
 #include <sstream>
 #include <iomanip>
+#include <vector>
+#include <cmath>
 #include "quadratic_probing.h"
 #include "linear_probing.h"
 #include "double_hashing.h"
@@ -59,6 +61,214 @@ void TestFunctionForHashTable(HashTableType &hash_table, const string &words_fil
     }
 }
 
+// Read every whitespace-separated word in a file, in order
+// Returns false if the file cannot be opened
+bool ReadWords(const string &filename, vector<string> &words) {
+    ifstream infile(filename);
+    if (!infile.is_open())
+        return false;
+    string word;
+    while (infile >> word) {
+        words.push_back(word);
+    }
+    return true;
+}
+
+// Return each word once, in order of first appearance
+vector<string> DistinctWords(const vector<string> &words) {
+    HashTableDouble<string> seen;
+    vector<string> distinct;
+    for (const string &word : words) {
+        if (seen.Insert(word)) // Insert fails for words already seen
+            distinct.push_back(word);
+    }
+    return distinct;
+}
+
+// Expected probes per search at load factor a, from the standard analysis of each scheme.
+// hit selects a successful search; otherwise an unsuccessful one.
+// Linear probing suffers primary clustering.
+double ExpectedProbesLinear(double a, bool hit) {
+    return hit ? 0.5 * (1 + 1 / (1 - a)) : 0.5 * (1 + 1 / ((1 - a) * (1 - a)));
+}
+
+// Quadratic probing suffers secondary clustering only.
+double ExpectedProbesQuadratic(double a, bool hit) {
+    return hit ? 1 - log(1 - a) - a / 2 : 1 / (1 - a) - a - log(1 - a);
+}
+
+// Double hashing behaves like uniform hashing.
+double ExpectedProbesDouble(double a, bool hit) {
+    if (a == 0)
+        return 1;
+    return hit ? log(1 / (1 - a)) / a : 1 / (1 - a);
+}
+
+// Probe counts measured for successful and unsuccessful searches
+struct ProbeStats {
+    size_t hits = 0;
+    size_t hit_probes = 0;
+    size_t misses = 0;
+    size_t miss_probes = 0;
+
+    double AvgHitProbes() const {
+        return hits == 0 ? 0 : static_cast<double>(hit_probes) / hits;
+    }
+
+    double AvgMissProbes() const {
+        return misses == 0 ? 0 : static_cast<double>(miss_probes) / misses;
+    }
+};
+
+// Search for every word (hits) and for every query that is absent, plus each word
+// with a "#" appended, which never occurs in a word file (misses)
+template <typename HashTableType>
+ProbeStats MeasureProbes(const HashTableType &hash_table, const vector<string> &words, const vector<string> &queries) {
+    ProbeStats stats;
+    for (const string &word : words) {
+        int probes = 0;
+        if (hash_table.Contains(word, probes)) {
+            stats.hits++;
+            stats.hit_probes += probes;
+        }
+    }
+    vector<string> absent = queries;
+    for (const string &word : words) {
+        absent.push_back(word + "#");
+    }
+    for (const string &word : absent) {
+        int probes = 0;
+        if (!hash_table.Contains(word, probes)) {
+            stats.misses++;
+            stats.miss_probes += probes;
+        }
+    }
+    return stats;
+}
+
+// Print the lengths of runs of consecutive non-empty slots and the occupancy map.
+// Long runs are what make probe sequences long.
+template <typename HashTableType>
+void PrintOccupancy(const HashTableType &hash_table) {
+    const size_t table_size = hash_table.TableSize();
+    size_t start = 0; // Start scanning right after an empty slot so no run is split by the wrap around
+    while (start < table_size && hash_table.SlotState(start) != HashTableType::EMPTY) {
+        start++;
+    }
+    vector<size_t> run_counts(1, 0); // run_counts[length] = number of runs of that length
+    size_t run = 0;
+    size_t num_runs = 0;
+    size_t occupied = 0;
+    for (size_t i = 1; i <= table_size && start < table_size; ++i) {
+        size_t pos = (start + i) % table_size;
+        if (hash_table.SlotState(pos) != HashTableType::EMPTY) {
+            run++;
+            occupied++;
+            continue;
+        }
+        if (run > 0) {
+            if (run >= run_counts.size())
+                run_counts.resize(run + 1, 0);
+            run_counts[run]++;
+            num_runs++;
+        }
+        run = 0;
+    }
+
+    cout << "runs: " << num_runs << endl;
+    cout << "max_run_length: " << run_counts.size() - 1 << endl;
+    cout << "avg_run_length: " << fixed << setprecision(6)
+         << (num_runs == 0 ? 0.0 : static_cast<double>(occupied) / num_runs) << endl;
+    cout << "run_length_distribution:" << endl;
+    for (size_t length = 1; length < run_counts.size(); ++length) {
+        if (run_counts[length] > 0)
+            cout << length << " " << run_counts[length] << endl;
+    }
+    cout << endl;
+
+    // One character per slot: '#' active, 'x' deleted, '.' empty
+    const size_t row_length = 64;
+    cout << "occupancy_map:" << endl;
+    for (size_t pos = 0; pos < table_size; ++pos) {
+        switch (hash_table.SlotState(pos)) {
+            case HashTableType::ACTIVE: cout << '#'; break;
+            case HashTableType::DELETED: cout << 'x'; break;
+            default: cout << '.'; break;
+        }
+        if ((pos + 1) % row_length == 0 || pos + 1 == table_size)
+            cout << endl;
+    }
+}
+
+// Chi-square test of how evenly the hash function spreads the words over table_size buckets.
+// For a uniform hash the statistic is close to its degrees of freedom, so z stays within a few units of 0.
+void PrintHashUniformity(const vector<string> &words, size_t table_size) {
+    static hash<string> hf; // The same hash function the tables use
+    vector<size_t> buckets(table_size, 0);
+    for (const string &word : words) {
+        buckets[hf(word) % table_size]++;
+    }
+    double expected = static_cast<double>(words.size()) / table_size;
+    double chi_square = 0;
+    for (size_t count : buckets) {
+        chi_square += (count - expected) * (count - expected) / expected;
+    }
+    double degrees_of_freedom = table_size - 1;
+    cout << "chi_square: " << fixed << setprecision(6) << chi_square << endl;
+    cout << "degrees_of_freedom: " << static_cast<size_t>(degrees_of_freedom) << endl;
+    cout << "chi_square_z: " << fixed << setprecision(6)
+         << (chi_square - degrees_of_freedom) / sqrt(2 * degrees_of_freedom) << endl;
+}
+
+// Analysis mode: build the table from the distinct words and report where the probe cost comes from
+template <typename HashTableType>
+void AnalyzeHashTable(HashTableType &hash_table, const vector<string> &words, const vector<string> &queries,
+                      double (*expected_probes)(double, bool)) {
+    for (const string &word : words) {
+        hash_table.Insert(word);
+    }
+
+    double load_factor = static_cast<double>(hash_table.Size()) / hash_table.TableSize();
+    ProbeStats stats = MeasureProbes(hash_table, words, queries);
+    cout << "number_of_elements: " << hash_table.Size() << endl;
+    cout << "size_of_table: " << hash_table.TableSize() << endl;
+    cout << "load_factor: " << fixed << setprecision(6) << load_factor << endl;
+    cout << "expected_hit_probes: " << expected_probes(load_factor, true) << endl;
+    cout << "measured_hit_probes: " << stats.AvgHitProbes() << endl;
+    cout << "expected_miss_probes: " << expected_probes(load_factor, false) << endl;
+    cout << "measured_miss_probes: " << stats.AvgMissProbes() << endl;
+    PrintHashUniformity(words, hash_table.TableSize());
+    cout << endl;
+    PrintOccupancy(hash_table);
+}
+
+// Build a double hashing table for every prime R below the initial table size and report the
+// R with the fewest probes (average hit probes plus average miss probes).
+// R must stay below the table size so one wrap around keeps each probe in range.
+void SweepRValues(const vector<string> &words, const vector<string> &queries) {
+    const size_t initial_size = 101;
+    int best_r = 0;
+    double best_cost = 0;
+    cout << "r_sweep:" << endl;
+    for (int r = 2; r < static_cast<int>(initial_size); ++r) {
+        if (!IsPrime(r))
+            continue;
+        HashTableDouble<string> double_probing_table(initial_size, r);
+        for (const string &word : words) {
+            double_probing_table.Insert(word);
+        }
+        ProbeStats stats = MeasureProbes(double_probing_table, words, queries);
+        double cost = stats.AvgHitProbes() + stats.AvgMissProbes();
+        cout << r << " " << fixed << setprecision(6) << stats.AvgHitProbes() << " " << stats.AvgMissProbes() << endl;
+        if (best_r == 0 || cost < best_cost) {
+            best_r = r;
+            best_cost = cost;
+        }
+    }
+    cout << "best_r_value: " << best_r << endl;
+    cout << endl;
+}
+
 // Wrapper function to handle command-line arguments and call the appropriate hash table test function
 int testHashingWrapper(int argument_count, char **argument_list) {
     const string words_filename(argument_list[1]); // Get the words file name from arguments
@@ -82,8 +292,34 @@ int testHashingWrapper(int argument_count, char **argument_list) {
         cout << "r_value: " << R << endl;
         HashTableDouble<string> double_probing_table(101, R); // Create hash table with specified size and R value
         TestFunctionForHashTable(double_probing_table, words_filename, query_filename);
+    } else if (param_flag == "linear_analysis" || param_flag == "quadratic_analysis" || param_flag == "double_analysis") {
+        // Read both files once, up front, and share them between the sweep and the analysis
+        vector<string> all_words;
+        vector<string> queries;
+        if (!ReadWords(words_filename, all_words) || !ReadWords(query_filename, queries)) {
+            cerr << "Unable to open file" << endl; // Print error message if files can't be opened
+            return 0;
+        }
+        const vector<string> words = DistinctWords(all_words);
+        if (words.empty()) {
+            cerr << "No words in " << words_filename << endl;
+            return 0;
+        }
+        if (param_flag == "linear_analysis") {
+            HashTableLinear<string> linear_probing_table;
+            AnalyzeHashTable(linear_probing_table, words, queries, ExpectedProbesLinear);
+        } else if (param_flag == "quadratic_analysis") {
+            HashTable<string> quadratic_probing_table;
+            AnalyzeHashTable(quadratic_probing_table, words, queries, ExpectedProbesQuadratic);
+        } else {
+            SweepRValues(words, queries);
+            cout << "r_value: " << R << endl;
+            HashTableDouble<string> double_probing_table(101, R);
+            AnalyzeHashTable(double_probing_table, words, queries, ExpectedProbesDouble);
+        }
     } else {
-        cout << "Unknown hash type " << param_flag << " (User should provide linear, quadratic, or double)" << endl;
+        cout << "Unknown hash type " << param_flag
+             << " (User should provide linear, quadratic, double, or one of them followed by _analysis)" << endl;
     }
     return 0;
 }
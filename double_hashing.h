@@ -81,6 +81,11 @@ class HashTableDouble {
     return num_collisions_;
   }
 
+  // Get the state of the slot at current_pos (used by the analysis mode)
+  EntryType SlotState(size_t current_pos) const {
+    return array_[current_pos].info_;
+  }
+
  private:
   // Structure to represent each entry in the hash table
   struct HashEntry {
@@ -0,0 +1,296 @@
+// Farhin Bhuiyan
+#ifndef HASH_MAP_H // Include guard to prevent multiple inclusions of this header file
+#define HASH_MAP_H
+
+#include <vector>         // Include vector for dynamic array
+#include <algorithm>      // Include algorithm for standard algorithms
+#include <functional>     // Include functional for hash functions
+#include <new>            // Include new for placement new
+#include <type_traits>    // Include type_traits for aligned_storage
+#include <utility>        // Include utility for std::forward and std::move
+#include "common.h"       // Include common functions and definitions
+
+// Key/value map using the same double hashing probe sequence as HashTableDouble.
+// Keys and their states live in one array; values live in a parallel flat array
+// indexed by the same slot. A lookup runs std::hash once and derives both the
+// start slot and the probe step from that one value, then finds key and value together.
+// The value array is uninitialized storage: a value is constructed in its slot
+// with placement new when its key is inserted and destroyed when it is removed,
+// so Value does not need a default constructor or assignment operator.
+template <typename Key, typename Value>
+class HashMap {
+ public:
+  // Enum to define the state of each entry in the hash map
+  enum EntryType { ACTIVE, EMPTY, DELETED };
+
+  // Constructor to initialize the hash map with a given size and R value
+  explicit HashMap(size_t size = 101, int r = 89)
+    : array_(NextPrime(size)), values_(array_.size()), R_(r) {
+    MakeEmpty(); // Initialize the map to empty state
+  }
+
+  // Copy constructor: copy-construct the value of every active slot
+  HashMap(const HashMap & other)
+    : array_(other.array_), values_(other.values_.size()), current_size_(other.current_size_),
+      occupied_(other.occupied_), num_collisions_(other.num_collisions_), R_(other.R_) {
+    for (size_t i = 0; i < array_.size(); ++i)
+      if (IsActive(i))
+        ::new (static_cast<void *>(ValueAt(i))) Value(*other.ValueAt(i));
+  }
+
+  // Move constructor: take over the other map's storage and leave it as a fresh, usable empty map
+  HashMap(HashMap && other) : HashMap(101, other.R_) {
+    Swap(other);
+  }
+
+  // Copy and move assignment
+  HashMap & operator=(HashMap other) {
+    Swap(other);
+    return *this;
+  }
+
+  // Destructor: destroy the value of every active slot
+  ~HashMap() {
+    DestroyValues();
+  }
+
+  // Check if a key is in the hash map and count the number of probes
+  bool Contains(const Key & key, int &probes) const {
+    size_t current_pos = FindPos(key, probes);
+    return IsActive(current_pos);
+  }
+
+  // Check if a key is in the hash map
+  bool Contains(const Key & key) const {
+    int probes = 0;
+    return Contains(key, probes);
+  }
+
+  // Return a pointer to the value stored for key, or nullptr if it is absent
+  Value *Find(const Key & key, int &probes) {
+    size_t current_pos = FindPos(key, probes);
+    return IsActive(current_pos) ? ValueAt(current_pos) : nullptr;
+  }
+
+  const Value *Find(const Key & key, int &probes) const {
+    size_t current_pos = FindPos(key, probes);
+    return IsActive(current_pos) ? ValueAt(current_pos) : nullptr;
+  }
+
+  Value *Find(const Key & key) {
+    int probes = 0;
+    return Find(key, probes);
+  }
+
+  const Value *Find(const Key & key) const {
+    int probes = 0;
+    return Find(key, probes);
+  }
+
+  // Construct a value from args in key's slot only if key is absent.
+  // The args are left untouched when key already exists.
+  // Returns true if a new entry was inserted.
+  template <typename K, typename... Args>
+  bool TryEmplace(K && key, Args &&... args) {
+    size_t current_pos = FindPos(key);
+    if (IsActive(current_pos)) // Key already exists
+      return false;
+    Place(current_pos, std::forward<K>(key), std::forward<Args>(args)...);
+    return true;
+  }
+
+  // Construct a value from args in key's slot, replacing any old value.
+  // Returns true if a new entry was inserted, false if a value was replaced.
+  template <typename K, typename... Args>
+  bool Emplace(K && key, Args &&... args) {
+    size_t current_pos = FindPos(key);
+    if (IsActive(current_pos)) { // Key already exists, replace its value
+      // Build the new value before destroying the old one, since args may refer to it
+      Value new_value(std::forward<Args>(args)...);
+      ValueAt(current_pos)->~Value();
+      array_[current_pos].info_ = DELETED; // Stays deleted if the new value throws
+      --current_size_;
+      ::new (static_cast<void *>(ValueAt(current_pos))) Value(std::move(new_value));
+      array_[current_pos].info_ = ACTIVE;
+      ++current_size_;
+      return false;
+    }
+    Place(current_pos, std::forward<K>(key), std::forward<Args>(args)...);
+    return true;
+  }
+
+  // Return the value stored for key, inserting a value-initialized one if absent
+  template <typename K>
+  Value & operator[](K && key) {
+    size_t current_pos = FindPos(key);
+    if (!IsActive(current_pos)) // Key does not exist yet
+      current_pos = Place(current_pos, std::forward<K>(key));
+    return *ValueAt(current_pos);
+  }
+
+  // Remove a key and its value from the hash map
+  bool Remove(const Key & key) {
+    size_t current_pos = FindPos(key);
+    if (!IsActive(current_pos)) // Key does not exist
+      return false;
+    ValueAt(current_pos)->~Value(); // Destroy the value in its slot
+    array_[current_pos].info_ = DELETED; // Mark as deleted
+    --current_size_;
+    return true;
+  }
+
+  // Make the hash map empty
+  void MakeEmpty() {
+    DestroyValues();
+    current_size_ = 0;
+    occupied_ = 0;
+    for (auto &entry : array_)
+      entry.info_ = EMPTY; // Mark all entries as empty
+  }
+
+  // Get the current number of entries in the hash map
+  size_t Size() const {
+    return current_size_;
+  }
+
+  // Get the size of the hash map
+  size_t TableSize() const {
+    return array_.size();
+  }
+
+  // Get the number of collisions that have occurred
+  size_t NumCollisions() const {
+    return num_collisions_;
+  }
+
+ private:
+  // Structure to represent each key slot in the hash map
+  struct HashEntry {
+    Key key_; // The key stored
+    EntryType info_; // The state of the entry
+
+    // Constructors for HashEntry
+    HashEntry(const Key & k = Key{}, EntryType i = EMPTY)
+      : key_{ k }, info_{ i } {}
+
+    HashEntry(Key && k, EntryType i = EMPTY)
+      : key_{ std::move(k) }, info_{ i } {}
+  };
+
+  // Raw, suitably aligned storage for one value
+  typedef typename std::aligned_storage<sizeof(Value), alignof(Value)>::type ValueStorage;
+
+  std::vector<HashEntry> array_; // The array of key slots
+  std::vector<ValueStorage> values_; // The values, indexed by the same slot as their key; live only in ACTIVE slots
+  size_t current_size_ = 0; // Current number of live entries in the hash map
+  size_t occupied_ = 0; // Number of slots that are ACTIVE or DELETED
+  mutable size_t num_collisions_ = 0; // Number of collisions (mutable to allow modification in const functions)
+  int R_;  // The R value used in double hashing.
+
+  // Check if a position in the hash map is active
+  bool IsActive(size_t current_pos) const {
+    return array_[current_pos].info_ == ACTIVE;
+  }
+
+  // Get the value stored in a slot (only valid for active slots)
+  Value *ValueAt(size_t current_pos) {
+    return reinterpret_cast<Value *>(&values_[current_pos]);
+  }
+
+  const Value *ValueAt(size_t current_pos) const {
+    return reinterpret_cast<const Value *>(&values_[current_pos]);
+  }
+
+  // Exchange the contents of this map and other
+  void Swap(HashMap & other) {
+    std::swap(array_, other.array_);
+    std::swap(values_, other.values_);
+    std::swap(current_size_, other.current_size_);
+    std::swap(occupied_, other.occupied_);
+    std::swap(num_collisions_, other.num_collisions_);
+    std::swap(R_, other.R_);
+  }
+
+  // Destroy the value of every active slot
+  void DestroyValues() {
+    for (size_t i = 0; i < array_.size(); ++i)
+      if (IsActive(i))
+        ValueAt(i)->~Value();
+  }
+
+  // Store key and construct a value from args at an empty slot.
+  // Returns the slot the entry ends up in, which changes if a rehash happens.
+  template <typename K, typename... Args>
+  size_t Place(size_t current_pos, K && key, Args &&... args) {
+    array_[current_pos].key_ = std::forward<K>(key); // Insert the key
+    ::new (static_cast<void *>(ValueAt(current_pos))) Value(std::forward<Args>(args)...); // Build the value in its slot
+    array_[current_pos].info_ = ACTIVE; // Mark as active
+    ++current_size_;
+    if (++occupied_ > array_.size() / 2) // Check load factor, counting deleted slots
+      current_pos = Rehash(current_pos); // Rehash if necessary
+    return current_pos;
+  }
+
+  // Find the position of a key in the hash map and count probes
+  size_t FindPos(const Key & key, int &probes) const {
+    static std::hash<Key> hf; // Use the standard hash function
+    size_t hash_value = hf(key); // Hash the key once for both the slot and the step
+    size_t current_pos = hash_value % array_.size(); // Primary hash
+    size_t offset = R_ - (hash_value % R_); // Secondary hash
+    probes = 1; // Start with one probe
+
+    // Double hashing: find the position or an empty slot
+    while (array_[current_pos].info_ != EMPTY &&
+           array_[current_pos].key_ != key) {
+      current_pos += offset; // Compute ith probe
+      probes++; // Increment the number of probes
+      num_collisions_++; // Increment the number of collisions
+      if (current_pos >= array_.size())
+        current_pos -= array_.size(); // Wrap around if necessary
+    }
+    return current_pos;
+  }
+
+  // Find the position of a key in the hash map without counting probes
+  size_t FindPos(const Key & key) const {
+    int probes = 0;
+    return FindPos(key, probes);
+  }
+
+  // Rehash the hash map when too many slots are in use.
+  // The table doubles if it is mostly live entries; otherwise it is rebuilt at
+  // the same size to drop deleted slots. Returns the new slot of tracked_pos.
+  size_t Rehash(size_t tracked_pos) {
+    std::vector<HashEntry> old_array = std::move(array_);
+    std::vector<ValueStorage> old_values = std::move(values_);
+
+    size_t new_size = old_array.size();
+    if (current_size_ > old_array.size() / 4)
+      new_size = NextPrime(2 * old_array.size());
+    array_ = std::vector<HashEntry>(new_size);
+    values_ = std::vector<ValueStorage>(new_size);
+
+    // Move the old entries into the new table, destroying the moved-from values
+    current_size_ = 0;
+    occupied_ = 0;
+    num_collisions_ = 0;
+    size_t new_tracked_pos = 0;
+    for (size_t i = 0; i < old_array.size(); ++i) {
+      if (old_array[i].info_ != ACTIVE)
+        continue;
+      Value *old_value = reinterpret_cast<Value *>(&old_values[i]);
+      size_t current_pos = FindPos(old_array[i].key_);
+      ::new (static_cast<void *>(ValueAt(current_pos))) Value(std::move(*old_value));
+      old_value->~Value();
+      array_[current_pos].key_ = std::move(old_array[i].key_);
+      array_[current_pos].info_ = ACTIVE;
+      ++current_size_;
+      ++occupied_;
+      if (i == tracked_pos)
+        new_tracked_pos = current_pos;
+    }
+    return new_tracked_pos;
+  }
+};
+
+#endif  // HASH_MAP_H
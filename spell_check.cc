@@ -8,10 +8,15 @@
 #include <vector>           // Include vector for dynamic arrays
 #include <algorithm>        // Include algorithm for standard algorithms
 #include <cctype>           // Include cctype for character handling functions
+#include <cstdlib>          // Include cstdlib for strtoul
+#include <cerrno>           // Include cerrno for strtoul range errors
+#include <iomanip>          // Include iomanip for output formatting
 
 // You can change to quadratic probing if you
 // haven't implemented double hashing.
 #include "double_hashing.h" // Include double hashing implementation
+#include "hash_map.h"       // Include hash map for word frequencies
+#include "clock_cache.h"    // Include clock cache for repeated words
 using namespace std;
 
 // Helper function to remove punctuation and convert to lowercase
@@ -36,6 +41,48 @@ HashTableDouble<string> MakeDictionary(const string &dictionary_file) {
   return dictionary_hash; // Return the populated hash table
 }
 
+// Parse text as a non-negative decimal number.
+// Returns false for empty, signed, non-numeric, or out of range text.
+bool ParseCount(const string &text, unsigned long &value) {
+  if (text.empty() || !isdigit(static_cast<unsigned char>(text[0]))) // Rejects "-1", "+1", and " 1"
+    return false;
+  char *end = nullptr;
+  errno = 0;
+  value = strtoul(text.c_str(), &end, 10);
+  return errno == 0 && *end == '\0';
+}
+
+// Fills dictionary_map with every word from dictionary_file, mapped to its frequency.
+// Each line of frequency_file is "<word> <count>"; counts for words that are not
+// in the dictionary are ignored, and dictionary words missing from it get 0.
+// Returns false if the frequency file cannot be opened.
+bool MakeFrequencyDictionary(const string &dictionary_file, const string &frequency_file,
+                             HashMap<string, unsigned long> &dictionary_map) {
+  ifstream frequency_infile(frequency_file); // Open the frequency file
+  if (!frequency_infile.is_open()) {
+    cerr << "Unable to open file " << frequency_file << endl; // Print error message if the file can't be opened
+    return false;
+  }
+  ifstream dictionary_infile(dictionary_file); // Open the dictionary file
+  string word;
+  while (dictionary_infile >> word) { // Read each word from the dictionary file
+    dictionary_map.TryEmplace(CleanWord(word), 0UL); // Insert cleaned word with no frequency yet
+  }
+  string count_text;
+  while (frequency_infile >> word) { // Read each word and its count
+    unsigned long frequency = 0;
+    if (!(frequency_infile >> count_text) || !ParseCount(count_text, frequency)) {
+      cerr << "Warning: malformed count for \"" << word << "\" in " << frequency_file
+           << ", ignoring the rest of the file" << endl;
+      break;
+    }
+    unsigned long *count = dictionary_map.Find(CleanWord(word));
+    if (count != nullptr) // Only keep counts for dictionary words
+      *count += frequency;
+  }
+  return true;
+}
+
 // Generate possible corrections by adding one character
 vector<string> AddOneChar(const string &word) {
   vector<string> corrections; // Vector to store possible corrections
@@ -63,7 +110,7 @@ vector<string> RemoveOneChar(const string &word) {
 // Generate possible corrections by swapping adjacent characters
 vector<string> SwapAdjacentChars(const string &word) {
   vector<string> corrections; // Vector to store possible corrections
-  for (size_t i = 0; i < word.size() - 1; ++i) {
+  for (size_t i = 0; i + 1 < word.size(); ++i) {
     string corrected_word = word;
     swap(corrected_word[i], corrected_word[i + 1]); // Swap adjacent characters
     corrections.push_back(corrected_word); // Add to corrections vector
@@ -71,8 +118,100 @@ vector<string> SwapAdjacentChars(const string &word) {
   return corrections; // Return all possible corrections
 }
 
-// For each word in the document_file, it checks the 3 cases for a word being misspelled and prints out possible corrections
-void SpellChecker(const HashTableDouble<string>& dictionary, const string &document_file) {
+// A dictionary word suggested for a misspelled word, with its frequency (0 outside
+// frequency mode) and the case that produced it
+struct Correction {
+  string word_;
+  unsigned long frequency_;
+  char case_;
+};
+
+// Number of distinct misspelled words whose corrections are remembered unless --cache says otherwise
+const size_t kDefaultCacheSize = 1024;
+
+// Print that cleaned_word is misspelled, followed by its corrections
+void PrintCorrections(const string &cleaned_word, const vector<Correction> &corrections) {
+  cout << cleaned_word << " is INCORRECT" << endl; // Print if the word is incorrect
+  for (const Correction &correction : corrections) {
+    cout << "** " << cleaned_word << " -> " << correction.word_ << " ** case " << correction.case_ << endl;
+  }
+}
+
+// Checks the 3 cases for a misspelled word and collects every correction found in the dictionary
+vector<Correction> FindCorrections(const HashTableDouble<string>& dictionary, const string &cleaned_word) {
+  vector<Correction> found;
+  int probes = 0; // Variable to count the number of probes
+  auto add_corrections = AddOneChar(cleaned_word); // Generate corrections by adding one character
+  auto remove_corrections = RemoveOneChar(cleaned_word); // Generate corrections by removing one character
+  auto swap_corrections = SwapAdjacentChars(cleaned_word); // Generate corrections by swapping adjacent characters
+  unordered_set<string> all_corrections(add_corrections.begin(), add_corrections.end()); // Store all corrections in an unordered set
+  all_corrections.insert(remove_corrections.begin(), remove_corrections.end()); // Add remove corrections to the set
+  all_corrections.insert(swap_corrections.begin(), swap_corrections.end()); // Add swap corrections to the set
+  for (const string &correction : all_corrections) { // Check each correction
+    if (dictionary.Contains(correction, probes)) { // If correction is in the dictionary
+      if (find(add_corrections.begin(), add_corrections.end(), correction) != add_corrections.end()) {
+        found.push_back({correction, 0, 'A'}); // Case A correction
+      } else if (find(remove_corrections.begin(), remove_corrections.end(), correction) != remove_corrections.end()) {
+        found.push_back({correction, 0, 'B'}); // Case B correction
+      } else if (find(swap_corrections.begin(), swap_corrections.end(), correction) != swap_corrections.end()) {
+        found.push_back({correction, 0, 'C'}); // Case C correction
+      }
+    }
+  }
+  return found;
+}
+
+// True if a should be listed before b: higher frequency first, then alphabetical
+bool RanksHigher(const Correction &a, const Correction &b) {
+  if (a.frequency_ != b.frequency_)
+    return a.frequency_ > b.frequency_;
+  return a.word_ < b.word_;
+}
+
+// Offer each candidate to top, a heap of at most k corrections whose front is the lowest ranked one
+void OfferCorrections(const HashMap<string, unsigned long>& dictionary, const vector<string> &candidates,
+                      char case_label, size_t k, vector<Correction> &top) {
+  for (const string &candidate : candidates) {
+    const unsigned long *frequency = dictionary.Find(candidate);
+    if (frequency == nullptr) // Not a dictionary word
+      continue;
+    Correction correction{candidate, *frequency, case_label};
+    if (top.size() == k && !RanksHigher(correction, top.front())) // Not better than the current k-th
+      continue;
+    bool duplicate = false; // The same word can come from more than one case
+    for (const Correction &kept : top)
+      duplicate = duplicate || kept.word_ == candidate;
+    if (duplicate)
+      continue;
+    if (top.size() == k) { // Evict the lowest ranked correction
+      pop_heap(top.begin(), top.end(), RanksHigher);
+      top.pop_back();
+    }
+    top.push_back(correction);
+    push_heap(top.begin(), top.end(), RanksHigher);
+  }
+}
+
+// Like FindCorrections, but keeps only the k most frequent corrections,
+// highest frequency first and alphabetically among ties
+vector<Correction> FindRankedCorrections(const HashMap<string, unsigned long>& dictionary, const string &cleaned_word,
+                                         size_t k) {
+  vector<Correction> top; // Heap of the best corrections so far
+  if (k == 0)
+    return top;
+  OfferCorrections(dictionary, AddOneChar(cleaned_word), 'A', k, top); // Case A corrections
+  OfferCorrections(dictionary, RemoveOneChar(cleaned_word), 'B', k, top); // Case B corrections
+  OfferCorrections(dictionary, SwapAdjacentChars(cleaned_word), 'C', k, top); // Case C corrections
+  sort_heap(top.begin(), top.end(), RanksHigher); // At most k entries, best first
+  return top;
+}
+
+// Prints the verdict for each word in document_file.
+// Correct words are answered by the dictionary directly, since that is a single probe.
+// The corrections of misspelled words are kept in cache so a repeated typo is not corrected again.
+template <typename Dictionary, typename CorrectionFunction>
+void CheckDocument(const Dictionary &dictionary, const string &document_file,
+                   ClockCache<string, vector<Correction>> &cache, CorrectionFunction find_corrections) {
   ifstream infile(document_file); // Open the document file
   string word;
   while (infile >> word) { // Read each word from the document file
@@ -80,39 +219,125 @@ void SpellChecker(const HashTableDouble<string>& dictionary, const string &docum
     int probes = 0; // Variable to count the number of probes
     if (dictionary.Contains(cleaned_word, probes)) { // Check if the cleaned word is in the dictionary
       cout << cleaned_word << " is CORRECT" << endl; // Print if the word is correct
-    } else {
-      cout << cleaned_word << " is INCORRECT" << endl; // Print if the word is incorrect
-      auto add_corrections = AddOneChar(cleaned_word); // Generate corrections by adding one character
-      auto remove_corrections = RemoveOneChar(cleaned_word); // Generate corrections by removing one character
-      auto swap_corrections = SwapAdjacentChars(cleaned_word); // Generate corrections by swapping adjacent characters
-      unordered_set<string> all_corrections(add_corrections.begin(), add_corrections.end()); // Store all corrections in an unordered set
-      all_corrections.insert(remove_corrections.begin(), remove_corrections.end()); // Add remove corrections to the set
-      all_corrections.insert(swap_corrections.begin(), swap_corrections.end()); // Add swap corrections to the set
-      for (const string &correction : all_corrections) { // Check each correction
-        if (dictionary.Contains(correction, probes)) { // If correction is in the dictionary
-          if (find(add_corrections.begin(), add_corrections.end(), correction) != add_corrections.end()) {
-            cout << "** " << cleaned_word << " -> " << correction << " ** case A" << endl; // Print case A correction
-          } else if (find(remove_corrections.begin(), remove_corrections.end(), correction) != remove_corrections.end()) {
-            cout << "** " << cleaned_word << " -> " << correction << " ** case B" << endl; // Print case B correction
-          } else if (find(swap_corrections.begin(), swap_corrections.end(), correction) != swap_corrections.end()) {
-            cout << "** " << cleaned_word << " -> " << correction << " ** case C" << endl; // Print case C correction
-          }
-        }
-      }
+      continue;
     }
+    const vector<Correction> *cached = cache.Get(cleaned_word);
+    if (cached != nullptr) { // Seen recently, reuse its corrections
+      PrintCorrections(cleaned_word, *cached);
+      continue;
+    }
+    vector<Correction> corrections = find_corrections(cleaned_word);
+    PrintCorrections(cleaned_word, corrections);
+    cache.Put(cleaned_word, std::move(corrections));
   }
 }
 
+// For each word in the document_file, it checks the 3 cases for a word being misspelled and prints out possible corrections
+void SpellChecker(const HashTableDouble<string>& dictionary, const string &document_file,
+                  ClockCache<string, vector<Correction>> &cache) {
+  CheckDocument(dictionary, document_file, cache, [&dictionary](const string &cleaned_word) {
+    return FindCorrections(dictionary, cleaned_word);
+  });
+}
+
+void SpellChecker(const HashTableDouble<string>& dictionary, const string &document_file) {
+  ClockCache<string, vector<Correction>> cache(kDefaultCacheSize);
+  SpellChecker(dictionary, document_file, cache);
+}
+
+// Like SpellChecker, but prints only the k most frequent corrections for each misspelled word,
+// highest frequency first and alphabetically among ties
+void RankedSpellChecker(const HashMap<string, unsigned long>& dictionary, const string &document_file, size_t k,
+                        ClockCache<string, vector<Correction>> &cache) {
+  CheckDocument(dictionary, document_file, cache, [&dictionary, k](const string &cleaned_word) {
+    return FindRankedCorrections(dictionary, cleaned_word, k);
+  });
+}
+
+// Print the cache statistics to standard error so they do not mix with the spell check output
+void PrintCacheStats(const ClockCache<string, vector<Correction>> &cache) {
+  if (cache.Capacity() == 0) {
+    cerr << "cache: disabled" << endl;
+    return;
+  }
+  cerr << "cache_capacity: " << cache.Capacity() << endl;
+  cerr << "cache_size: " << cache.Size() << endl;
+  cerr << "cache_hits: " << cache.Hits() << endl;
+  cerr << "cache_misses: " << cache.Misses() << endl;
+  cerr << "cache_evictions: " << cache.Evictions() << endl;
+  cerr << "cache_hit_rate: " << fixed << setprecision(6) << cache.HitRate() << endl;
+}
+
+// Print how to run the program
+void PrintUsage(const char *program) {
+  cout << "Usage: " << program << " <document-file> <dictionary-file>" << endl;
+  cout << "or Usage: " << program << " <document-file> <dictionary-file> [--frequency <frequency-file>] [--top <k>] [--cache <entries>]" << endl;
+}
+
 // @argument_count: same as argc in main
 // @argument_list: same as argv in main.
 // Implements the functionality by calling appropriate functions with the provided arguments
+// Optional arguments after the two file names:
+//   --frequency <file>  print only the top-k corrections ranked by the word counts in <file>
+//   --top <k>           number of corrections kept in frequency mode (default 3); requires --frequency
+//   --cache <entries>   most distinct misspelled words whose corrections are cached (default 1024, 0 disables);
+//                       also prints cache statistics to standard error
 int testSpellingWrapper(int argument_count, char** argument_list) {
   const string document_filename(argument_list[1]); // Get the document file name from arguments
   const string dictionary_filename(argument_list[2]); // Get the dictionary file name from arguments
 
-  // Call functions implementing the assignment requirements.
-  HashTableDouble<string> dictionary = MakeDictionary(dictionary_filename); // Create and populate the dictionary hash table
-  SpellChecker(dictionary, document_filename); // Check the spelling in the document file
+  string frequency_filename; // Empty unless frequency mode is requested
+  unsigned long top_k = 3; // Default number of ranked corrections
+  bool top_given = false; // --top only makes sense with --frequency
+  unsigned long cache_size = kDefaultCacheSize; // Default number of cached misspelled words
+  bool print_cache_stats = false; // Only report statistics when the cache was configured
+  if (argument_count % 2 == 0) { // Every option needs a value
+    PrintUsage(argument_list[0]);
+    return 1;
+  }
+  for (int i = 3; i + 1 < argument_count; i += 2) {
+    const string option(argument_list[i]);
+    if (option == "--frequency") {
+      frequency_filename = argument_list[i + 1];
+    } else if (option == "--top") {
+      if (!ParseCount(argument_list[i + 1], top_k)) {
+        cerr << "Invalid --top value " << argument_list[i + 1] << endl;
+        PrintUsage(argument_list[0]);
+        return 1;
+      }
+      top_given = true;
+    } else if (option == "--cache") {
+      if (!ParseCount(argument_list[i + 1], cache_size)) {
+        cerr << "Invalid --cache value " << argument_list[i + 1] << endl;
+        PrintUsage(argument_list[0]);
+        return 1;
+      }
+      print_cache_stats = true;
+    } else {
+      cerr << "Unknown option " << option << endl;
+      PrintUsage(argument_list[0]);
+      return 1;
+    }
+  }
+  if (top_given && frequency_filename.empty()) {
+    cerr << "--top requires --frequency" << endl;
+    PrintUsage(argument_list[0]);
+    return 1;
+  }
+
+  ClockCache<string, vector<Correction>> cache(cache_size); // Corrections of recently seen misspelled words
+  if (!frequency_filename.empty()) {
+    HashMap<string, unsigned long> dictionary;
+    if (!MakeFrequencyDictionary(dictionary_filename, frequency_filename, dictionary))
+      return 1;
+    RankedSpellChecker(dictionary, document_filename, top_k, cache); // Check the spelling, printing ranked corrections
+  } else {
+    // Call functions implementing the assignment requirements.
+    HashTableDouble<string> dictionary = MakeDictionary(dictionary_filename); // Create and populate the dictionary hash table
+    SpellChecker(dictionary, document_filename, cache); // Check the spelling in the document file
+  }
+  if (print_cache_stats)
+    PrintCacheStats(cache);
 
   return 0;
 }
@@ -122,8 +347,8 @@ int testSpellingWrapper(int argument_count, char** argument_list) {
 // WE WILL DIRECTLY CALL testSpellingWrapper. ALL FUNCTIONALITY SHOULD BE THERE.
 // This main is only here for your own testing purposes.
 int main(int argc, char** argv) {
-  if (argc != 3) { // Check if the number of arguments is correct
-    cout << "Usage: " << argv[0] << " <document-file> <dictionary-file>" << endl; // Print usage instructions if the number of arguments is incorrect
+  if (argc < 3 || argc % 2 == 0) { // Check if the number of arguments is correct
+    PrintUsage(argv[0]); // Print usage instructions if the number of arguments is incorrect
     return 0;
   }
   